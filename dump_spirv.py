@@ -1,4 +1,5 @@
 import os.path
+import struct
 
 # Get the input and output destinations
 import argparse
@@ -12,22 +13,41 @@ if os.path.exists(args.input) != True:
     print("Failed to find input file " + args.input)
     exit(-1)
 
-out_str = "const uint8_t {}_data []  = {{".format(args.var_name)
-byte_count = 0
-
 with open(args.input, "rb") as f:
     binary_data = f.read()
-    byte_count = 0
-    for val in binary_data:
-        if byte_count % 10 == 0:
-            out_str += "\n\t"
-        byte_count += 1
-        out_str += "0x{:02x}".format(val) 
-        out_str += ", "
+
+# Spirv starts with a 5 word header, anything shorter can't be a shader
+if len(binary_data) < 20:
+    print("Spirv is too small to hold a header " + args.input)
+    exit(-1)
+
+# Spirv is a stream of 32 bit words, so emit it as uint32_t to get the alignment vulkan requires
+if len(binary_data) % 4 != 0:
+    print("Spirv size is not a multiple of 4 bytes " + args.input)
+    exit(-1)
+
+# The magic number tells us which byte order glslang wrote the words in. We write the words out
+# as values, so the compiler stores them in the byte order of whatever we're building for
+spirv_magic = 0x07230203
+word_count = len(binary_data) // 4
+if struct.unpack_from("<I", binary_data)[0] == spirv_magic:
+    words = struct.unpack("<{}I".format(word_count), binary_data)
+elif struct.unpack_from(">I", binary_data)[0] == spirv_magic:
+    words = struct.unpack(">{}I".format(word_count), binary_data)
+else:
+    print("Input is not spirv, magic number is wrong " + args.input)
+    exit(-1)
+
+out_str = "const uint32_t {}_data []  = {{".format(args.var_name)
+for word_index, val in enumerate(words):
+    if word_index % 8 == 0:
+        out_str += "\n\t"
+    out_str += "0x{:08x}".format(val)
+    out_str += ", "
 
 out_str += "\n};\n"
 
-out_str = "#include <stdint.h>\n\nconst uint32_t {}_size = 0x{:x};\n".format(args.var_name, byte_count) + out_str
+out_str = "#include <stdint.h>\n\nconst uint32_t {}_size = 0x{:x};\n".format(args.var_name, len(binary_data)) + out_str
 
 with open(args.output, "w") as f:
     f.write(out_str)
\ No newline at end of file
@@ -0,0 +1,27 @@
+#ifndef __GRAVELER_H__
+#define __GRAVELER_H__
+
+// Public C API of the graveler dice session engine. This doesn't need vulkan, it runs the exact same
+// sessions as the compute shader but on the CPU, so other programs can link the static library and
+// get results directly, or check a GPU run by replaying its sessions with the same seed.
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Runs count dice sessions with ids first_id, first_id + 1, ... and writes the number of 1s rolled in
+// each one to out[0 .. count-1].
+//
+// A session matches a GPU invocation when seed is the push constant of that one dispatch and the id is
+// its gl_GlobalInvocationID.x. The GPU id is 32 bit and starts from 0 again every dispatch (which also
+// gets a new seed), so only ids below 2^32 have a GPU equivalent. Bigger ids are still valid sessions
+void graveler_run_sessions(uint64_t seed, uint64_t first_id, size_t count, uint32_t* out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // !__GRAVELER_H__
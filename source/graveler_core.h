@@ -0,0 +1,126 @@
+/**
+ * Header only core of a dice session, this is shared between the compute shader and the CPU. The shader
+ * includes this file (with GRAVELER_GLSL defined before the include) and the host includes it as plain C,
+ * so there is exactly one copy of the seeding, prng and roll loop. If you change the maths here then
+ * both the GPU and the CPU paths get it, and they keep producing the same numbers for the same seeds.
+ *
+ * Everything in here has to be written in the common subset of C99 and GLSL 430 + int64 extension, so no
+ * pointers, no structs and no C only casts. Bits which only make sense on the host (dispatch math) are
+ * fenced off at the bottom of the file.
+ *
+ * No double underscores in the names in here, GLSL reserves them and glslang warns about defining them
+ */
+#ifndef GRAVELER_CORE_H
+#define GRAVELER_CORE_H
+
+#ifdef GRAVELER_GLSL
+// GLSL already has uint64_t from GL_ARB_gpu_shader_int64, just need the 32 bit name and the literal suffix
+#define uint32_t uint
+#define GRAVELER_U64(VAL) VAL##ul
+#define GRAVELER_FUNC
+#else
+#include <stdint.h>
+#define GRAVELER_U64(VAL) VAL##ull
+#define GRAVELER_FUNC static inline
+#endif
+
+// A dice session is 231 rolls, and the session is over early if we ever hit 177 1s
+#define GRAVELER_ROLLS_PER_SESSION 231u
+#define GRAVELER_TARGET_ONES 177u
+
+// The prng should evenly distribute across entire uint64_t range, so if it falls in the bottom quarter of
+// uint64_t we say that's the same as rolling a 1.
+#define GRAVELER_ONE_THRESHOLD GRAVELER_U64(0x3FFFFFFFFFFFFFFF)
+
+// Function which mixes the bits from an input in the hope of producing a a well mixed number
+// i.e we want close numbers to be far away from each other
+GRAVELER_FUNC uint64_t hash_bit_mix(uint64_t key) {
+	// This does Austin Appleby's MurmurHash3 algorithm
+	key ^= (key >> 33);
+	key *= GRAVELER_U64(0xff51afd7ed558ccd);
+	key ^= (key >> 33);
+	key *= GRAVELER_U64(0xc4ceb9fe1a85ec53);
+	key ^= (key >> 33);
+
+	return key;
+}
+
+// Slightly different aim from the bit mix, we want a sequence xn = f(xn-1) which produces uniformally
+// distributed psudorandom values
+GRAVELER_FUNC uint64_t next_rand(uint64_t past) {
+	// Implementation of Marsaglia's xorshift. Secondary source :
+	// https://towardsdatascience.com/how-to-generate-a-vector-of-random-numbers-on-a-gpu-a37230f887a6
+	past ^= (past << 13);
+	past ^= (past >> 17);
+	past ^= (past << 5);
+	return past;
+}
+
+// We take an initial seed for our random number to be the combination of the per dispatch seed and the
+// id of the session (the global invocation id on the GPU). Each is hashed to spread the seed out more
+GRAVELER_FUNC uint64_t session_seed(uint64_t pipe_seed, uint64_t session_id) {
+	return hash_bit_mix(pipe_seed) ^ hash_bit_mix(session_id);
+}
+
+// Counts one roll into the running number of 1s. Once we have hit 177 the count stops moving, which gives
+// the same answer as breaking out of the loop, the SSE2 lanes in graveler_sessions.c do the same thing with masks
+GRAVELER_FUNC uint32_t tally_roll(uint32_t number_of_1s, uint64_t rand) {
+	return (rand <= GRAVELER_ONE_THRESHOLD && number_of_1s < GRAVELER_TARGET_ONES) ? number_of_1s + 1u : number_of_1s;
+}
+
+// Perform a singular dice run, which will end when we get 177 1s or we have 231 rolls
+GRAVELER_FUNC uint32_t run_session(uint64_t seed) {
+	// Get the first random number in the sequence
+	uint64_t rand = next_rand(seed);
+	uint32_t number_of_1s = 0u;
+
+	for (uint32_t i = 0u; i < GRAVELER_ROLLS_PER_SESSION; ++i) {
+		rand = next_rand(rand); // next random number
+		number_of_1s = tally_roll(number_of_1s, rand);
+
+		// Only need to check when we could have finished
+		if (number_of_1s >= GRAVELER_TARGET_ONES) {
+			break; // exit loop if we hit 177
+		}
+	}
+	return number_of_1s;
+}
+
+#ifndef GRAVELER_GLSL
+
+// How do we plan to dispatch the compute shaders
+typedef struct ComputeDispatchDimentions {
+	uint32_t invocations_per_workgroup_x;
+	uint32_t workgroups_per_dispatch_x;
+	uint32_t dispatches_x;
+}ComputeDispatchDimentions;
+
+// Splits the total number of dice sessions into a 1D dispatch, one session per invocation. Takes the device
+// limits for the x dimension, max_invocations is maxComputeWorkGroupInvocations
+GRAVELER_FUNC ComputeDispatchDimentions graveler_dispatch_dimentions(uint64_t total_sessions, uint32_t max_invocations,
+	uint32_t max_workgroup_size_x, uint32_t max_workgroup_count_x) {
+
+	// Only dispatching in the x dimension, so we are capped by whichever is smaller
+	uint64_t invocations_per_workgroup = max_invocations;
+	if (invocations_per_workgroup > max_workgroup_size_x) invocations_per_workgroup = max_workgroup_size_x;
+
+	// Backup is to use multiple dispatches if we can't fit all the workgroups into one
+	uint64_t required_workgroup_count = (total_sessions + (invocations_per_workgroup - 1)) / invocations_per_workgroup;
+	uint64_t workgroups_per_dispatch = required_workgroup_count;
+	uint64_t required_dispatch_count = 1;
+	if (required_workgroup_count > max_workgroup_count_x) {
+		workgroups_per_dispatch = max_workgroup_count_x;
+		required_dispatch_count = (required_workgroup_count + (workgroups_per_dispatch - 1)) / workgroups_per_dispatch;
+	}
+
+	ComputeDispatchDimentions dispatch = {
+		.invocations_per_workgroup_x = (uint32_t)invocations_per_workgroup,
+		.workgroups_per_dispatch_x = (uint32_t)workgroups_per_dispatch,
+		.dispatches_x = (uint32_t)required_dispatch_count
+	};
+	return dispatch;
+}
+
+#endif // !GRAVELER_GLSL
+
+#endif // !GRAVELER_CORE_H
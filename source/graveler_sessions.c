@@ -0,0 +1,82 @@
+#include "graveler.h"
+#include "graveler_core.h"
+
+// SSE2 is part of x64, and MSVC targets it by default on 32 bit x86 too, so every build on my targets
+// gets the vector path without needing any extra compiler flags. Anything else just runs the scalar loop
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define GRAVELER_SSE2 1
+#include <emmintrin.h>
+#endif
+
+#ifdef GRAVELER_SSE2
+
+// Number of sessions we run side by side. An SSE2 register holds 2 uint64_t lanes, we step 4 registers
+// at once so there are independent xorshifts for the cpu to overlap
+#define GRAVELER_CPU_LANES 8
+#define GRAVELER_CPU_REGISTERS (GRAVELER_CPU_LANES / 2)
+
+// Runs GRAVELER_CPU_LANES sessions starting at first_id. We can't break out early per lane like the shader
+// does, so this is tally_roll written in SSE2, the count stops at 177 so the answer is still the same
+static void run_session_lanes(uint64_t seed, uint64_t first_id, uint32_t out[GRAVELER_CPU_LANES]) {
+	uint64_t lanes[GRAVELER_CPU_LANES];
+	__m128i rand[GRAVELER_CPU_REGISTERS];
+	__m128i number_of_1s[GRAVELER_CPU_REGISTERS];
+
+	// Seed every lane and get the first random number in the sequence
+	for (size_t l = 0; l < GRAVELER_CPU_LANES; l++) {
+		lanes[l] = next_rand(session_seed(seed, first_id + l));
+	}
+	for (size_t v = 0; v < GRAVELER_CPU_REGISTERS; v++) {
+		rand[v] = _mm_loadu_si128((const __m128i*)&lanes[v * 2]);
+		number_of_1s[v] = _mm_setzero_si128();
+	}
+
+	// Counts live in the low 32 bits of each 64 bit lane, the high half of these constants is 0 so the
+	// high half of the count never moves
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i one = _mm_set_epi32(0, 1, 0, 1);
+	const __m128i target = _mm_set_epi32(0, GRAVELER_TARGET_ONES, 0, GRAVELER_TARGET_ONES);
+
+	for (uint32_t i = 0; i < GRAVELER_ROLLS_PER_SESSION; i++) {
+		for (size_t v = 0; v < GRAVELER_CPU_REGISTERS; v++) {
+			// next_rand
+			__m128i r = rand[v];
+			r = _mm_xor_si128(r, _mm_slli_epi64(r, 13));
+			r = _mm_xor_si128(r, _mm_srli_epi64(r, 17));
+			r = _mm_xor_si128(r, _mm_slli_epi64(r, 5));
+			rand[v] = r;
+
+			// SSE2 has no unsigned 64 bit compare, but GRAVELER_ONE_THRESHOLD is 2^62 - 1 so rand is a 1 when
+			// the top two bits are clear. Then only count it while we're still under 177
+			__m128i is_one = _mm_cmpeq_epi32(_mm_srli_epi64(r, 62), zero);
+			__m128i counting = _mm_cmplt_epi32(number_of_1s[v], target);
+			number_of_1s[v] = _mm_add_epi32(number_of_1s[v], _mm_and_si128(_mm_and_si128(is_one, counting), one));
+		}
+	}
+
+	for (size_t v = 0; v < GRAVELER_CPU_REGISTERS; v++) {
+		_mm_storeu_si128((__m128i*)&lanes[v * 2], number_of_1s[v]);
+	}
+	for (size_t l = 0; l < GRAVELER_CPU_LANES; l++) {
+		out[l] = (uint32_t)lanes[l];
+	}
+}
+
+#endif // GRAVELER_SSE2
+
+void graveler_run_sessions(uint64_t seed, uint64_t first_id, size_t count, uint32_t* out) {
+	if (out == NULL) return;
+	size_t i = 0;
+
+#ifdef GRAVELER_SSE2
+	// Full batches of lanes go down the vector path
+	for (; i + GRAVELER_CPU_LANES <= count; i += GRAVELER_CPU_LANES) {
+		run_session_lanes(seed, first_id + i, &out[i]);
+	}
+#endif
+
+	// Whatever is left over (or everything without SSE2) runs one by one
+	for (; i < count; i++) {
+		out[i] = run_session(session_seed(seed, first_id + i));
+	}
+}
\ No newline at end of file
@@ -9,6 +9,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdbool.h>
+#include "graveler_core.h"
 
 #define MALLOC_CHECK(VAR_NAME) if(VAR_NAME == NULL) {printf("FATAL: Memory allocation for " #VAR_NAME " failed"); exit(-1);}
 
@@ -36,12 +37,7 @@ VkDebugUtilsMessengerEXT create_debug_messenger(VkInstance instance);
 // Selects the physical device to use. Exits on no vulkan physical devices 
 VkPhysicalDevice select_vk_physical_device(VkInstance instance);
 
-// How do we plan to dispatch the compute shaders 
-typedef struct ComputeDispatchDimentions {
-	uint32_t invocations_per_workgroup_x;
-	uint32_t workgroups_per_dispatch_x;
-	uint32_t dispatches_x;
-}ComputeDispatchDimentions;
+// How do we plan to dispatch the compute shaders, the math itself is shared in graveler_core.h
 ComputeDispatchDimentions select_dispatch_dimentions_from_limits(VkPhysicalDeviceLimits limits);
 
 // A group of info which we need to keep for submitting to the compute queue
@@ -321,31 +321,19 @@ ComputeDispatchDimentions select_dispatch_dimentions_from_limits(VkPhysicalDevic
 
 	// Under my constraints we will only be dispatching in x dimension, my device actually has max invocations and size[x]
 	// as equal, this is probably as the expect dispatches in flat lines or squares or cubes with a fixed capacity
-	uint64_t invocations_per_workgroup = limits.maxComputeWorkGroupInvocations;
-	if (invocations_per_workgroup > limits.maxComputeWorkGroupSize[0]) {
+	if (limits.maxComputeWorkGroupInvocations > limits.maxComputeWorkGroupSize[0]) {
 		printf("Warning: Workgroups could be more efficient in higher dimension dispatch\n");
-		invocations_per_workgroup = limits.maxComputeWorkGroupSize[0];
 	}
 
 	// In my example we're doing a single dice roll per invocation as it fits in a single dispatch
-	uint64_t required_workgroup_count = (num_dice_rolls + (invocations_per_workgroup - 1)) / invocations_per_workgroup;
 	// In the case that your device doesn't fit in one dispatch, I'll have a backup which performs multiple dispatches
 	// this is SOOOO much slower than just doing multiple rolls per invocation. You could make this customizable per 
 	// device with specialization constants but leave as exercise to reader
-	uint64_t workgroups_per_dispatch = required_workgroup_count;
-	uint64_t required_dispatch_count = 1;
-	if (required_workgroup_count > limits.maxComputeWorkGroupCount[0]) {
+	ComputeDispatchDimentions dispatch = graveler_dispatch_dimentions(num_dice_rolls, limits.maxComputeWorkGroupInvocations,
+		limits.maxComputeWorkGroupSize[0], limits.maxComputeWorkGroupCount[0]);
+	if (dispatch.dispatches_x > 1) {
 		printf("Warning: Using multiple dispatches, this is a limitation of how I've divided workload as one dispatch is enough on my device\n");
-		workgroups_per_dispatch = limits.maxComputeWorkGroupCount[0];
-		required_dispatch_count = (required_workgroup_count + (workgroups_per_dispatch - 1)) / workgroups_per_dispatch;
 	}
-	
-	// Pack to return to the user 
-	ComputeDispatchDimentions dispatch = { 
-		.invocations_per_workgroup_x = invocations_per_workgroup,
-		.workgroups_per_dispatch_x = workgroups_per_dispatch,
-		.dispatches_x = required_dispatch_count 
-	};
 	return dispatch;
 }
 
@@ -400,16 +388,15 @@ DeviceNQueue create_device(VkInstance instance, VkPhysicalDevice physical) {
 	return out;
 }
 
-extern const uint8_t spirv_random_roll_data[];
+extern const uint32_t spirv_random_roll_data[];
 extern const uint32_t spirv_random_roll_size;
 ComputePipeNShader create_dice_roll_shader(DeviceNQueue* dnq) {
 	ComputePipeNShader out = { 0 };
 
 	// Create the shader module
-	// We store the data inside the binary as a series of bytes, Vulkan wants it in uint32 for some reason, but it's not a good idea
-	// to store them as uint32 specifically due to endianness of the target compute might invert expected byte order 
-	const uint32_t* shader_data = (uint32_t*)(&spirv_random_roll_data[0]);
-	VkShaderModuleCreateInfo shader = { .sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO, .pCode = shader_data, .codeSize = spirv_random_roll_size };
+	// dump_spirv.py stores the spirv as an array of uint32 words, so it's aligned the way vulkan wants, and the words
+	// are written as values so the compiler puts them in the byte order of the target. Size is still in bytes
+	VkShaderModuleCreateInfo shader = { .sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO, .pCode = spirv_random_roll_data, .codeSize = spirv_random_roll_size };
 	VK_CHECK(dnq->pfn.vkCreateShaderModule(dnq->device, &shader, NULL, &out.shader));
 
 	// Layout has: --------------------------------------------------------
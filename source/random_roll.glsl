@@ -19,6 +19,7 @@
  */
 #version 430
 #extension GL_ARB_gpu_shader_int64 : require
+#extension GL_GOOGLE_include_directive : require
 
 // Push constant, data directly in the command buffer which seeds the random offset
 layout( push_constant ) uniform constants {
@@ -33,13 +34,9 @@ layout(std430, binding = 0) buffer RollResultSSBO {
 // Shared memory to track the highest score in the workgroup 
 shared uint wg_highest_dice_run;
 
-// Function which mixes the bits from an input in the hope of producing a a well mixed number
-// i.e we want close numbers to be far away from each other
-uint64_t hash_bit_mix(uint64_t key);
-
-// Slightly different aim from the bit mix, we want a sequence xn = f(xn-1) which produces uniformally
-// distributed psudorandom values
-uint64_t next_rand(uint64_t past);
+// The seeding, prng and the dice session loop live in a header shared with the CPU 
+#define GRAVELER_GLSL 1
+#include "graveler_core.h"
 
 void main() {
 	// One invocation in the workgroup should set the shared memory variables and then all 
@@ -49,31 +46,10 @@ void main() {
 	}
 	memoryBarrierShared();
 
-	// We take an initial seed for our random number to be the combination of the current time 
-	// from the push constant. We add in our global invocation id to make sure each thread has 
-	// a unique starting seed. Then we hash it to introduce entropy and spread the seed out more
-	uint64_t seed = hash_bit_mix(push_constants.pipe_seed) ^ hash_bit_mix(uint64_t(gl_GlobalInvocationID.x));
-
-	// Get the first random number in the sequence
-	uint64_t rand = next_rand(seed);
-	uint number_of_1s = 0;
-
-	// Perform a singular dice run, which will end when we get 177 1s or we have 231 rolls
-	for(uint i = 0; i < 231; ++i) {
-
-		// The prng should evenly distribute across entire uint64_t range, so it should have
-		// a roughly uniform distribute, if it falls in the bottom quarter of uint64_t we 
-		// say that's the same as rolling a 1.
-		rand = next_rand(rand); // next random number 
-		if(rand <= 0x3FFFFFFFFFFFFFFFl) {
-			number_of_1s+= 1;
-
-			// Only need to check when incremented
-			if(number_of_1s >= 177) {
-				break; // exit loop if we hit 177
-			}
-		}
-	}
+	// Each thread gets a unique seed from the push constant and our global invocation id,
+	// then performs a singular dice run, which will end when we get 177 1s or we have 231 rolls
+	uint64_t seed = session_seed(push_constants.pipe_seed, uint64_t(gl_GlobalInvocationID.x));
+	uint number_of_1s = run_session(seed);
 
 	// That is the end of this dice run in this invocation. Now within this workgroup
 	// who has the largest result?
@@ -87,23 +63,3 @@ void main() {
 	}
 	return;
 }
-
-uint64_t hash_bit_mix(uint64_t key) {
-	// This does Austin Appleby's MurmurHash3 algorithm
-	key ^= (key >> 33);
-  	key *= 0xff51afd7ed558ccdL;
-  	key ^= (key >> 33);
-  	key *= 0xc4ceb9fe1a85ec53L;
-  	key ^= (key >> 33);
-
-  	return key;
-}
-
-uint64_t next_rand(uint64_t past) {
-	// Implementation of Marsaglia’s xorshift. Secondary source : 
-	// https://towardsdatascience.com/how-to-generate-a-vector-of-random-numbers-on-a-gpu-a37230f887a6
-	past ^= (past << 13);
-    past ^= (past >> 17);    
-    past ^= (past << 5);    
-    return past;
-}
\ No newline at end of file
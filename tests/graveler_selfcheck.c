@@ -0,0 +1,41 @@
+#include "graveler.h"
+#include "graveler_core.h"
+#include <stdio.h>
+
+// Not a multiple of the cpu lane count so the leftover sessions get checked too
+#define num_sessions 1003
+
+// Runs sessions through the api and checks every one against the scalar loop the shader uses
+static int check_sessions(uint64_t seed, uint64_t first_id) {
+	static uint32_t results[num_sessions];
+	graveler_run_sessions(seed, first_id, num_sessions, results);
+
+	int mismatches = 0;
+	for (size_t i = 0; i < num_sessions; i++)
+	{
+		uint32_t expected = run_session(session_seed(seed, first_id + i));
+		if (results[i] != expected) {
+			printf("Mismatch: seed %llx session %llu got %u expected %u\n", (unsigned long long)seed,
+				(unsigned long long)(first_id + i), results[i], expected);
+			mismatches++;
+		}
+	}
+	return mismatches;
+}
+
+int main(int argc, char* argv[]) {
+	int mismatches = 0;
+	mismatches += check_sessions(0, 0);
+	mismatches += check_sessions(0x123456789abcdefull, 5);
+	mismatches += check_sessions(0xffffffffffffffffull, 0xfffffe00ull); // Runs over the 32 bit id boundary
+
+	// The api shouldn't write anything when there is nowhere to write to
+	graveler_run_sessions(0, 0, num_sessions, NULL);
+
+	if (mismatches != 0) {
+		printf("FATAL: %d sessions didn't match the scalar loop\n", mismatches);
+		return -1;
+	}
+	printf("Success: All sessions matched the scalar loop\n");
+	return 0;
+}